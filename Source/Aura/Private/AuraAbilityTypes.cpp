@@ -41,9 +41,13 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bo
 		{
 			RepBits |= 1 << 8;
 		}
+		if (bHasRandomSeed)
+		{
+			RepBits |= 1 << 9;
+		}
 	}
 
-	Ar.SerializeBits(&RepBits, 9);
+	Ar.SerializeBits(&RepBits, 10);
 
 	if (RepBits & (1 << 0))
 	{
@@ -93,6 +97,15 @@ bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bo
 	{
 		Ar << bIsCriticalHit;
 	}
+	if (RepBits & (1 << 9))
+	{
+		Ar << RandomSeed;
+		bHasRandomSeed = true;
+	}
+	else
+	{
+		bHasRandomSeed = false;
+	}
 
 	if (Ar.IsLoading())
 	{
@@ -16,6 +16,23 @@ public:
 	void SetIsCriticalHit(bool bInIsCriticalHit) { bIsCriticalHit = bInIsCriticalHit; }
 	void SetIsBlockedHit(bool bInIsBlockedHit) { bIsBlockedHit = bInIsBlockedHit; }
 
+	// Seed of the combat rolls (Block, Critical Hit) of this effect, set once by the first execution
+	bool HasRandomSeed() const { return bHasRandomSeed; }
+	int32 GetRandomSeed() const { return RandomSeed; }
+	void SetRandomSeed(int32 InRandomSeed) { RandomSeed = InRandomSeed; bHasRandomSeed = true; }
+
+	// Seed of a single execution: the effect seed combined with the Target and the execution count, so periodic
+	// executions and Targets sharing this context each roll their own Block and Critical Hit
+	int32 MakeExecutionRandomSeed(uint32 TargetHash)
+	{
+		return static_cast<int32>(HashCombine(HashCombine(static_cast<uint32>(RandomSeed), TargetHash), NumExecutions++));
+	}
+
+	// Damage already evaluated by UExecCalc_Damage::EvaluateDamageBatch, output as is by the execution. Server side only
+	bool HasResolvedDamage() const { return bHasResolvedDamage; }
+	float GetResolvedDamage() const { return ResolvedDamage; }
+	void SetResolvedDamage(float InResolvedDamage) { ResolvedDamage = InResolvedDamage; bHasResolvedDamage = true; }
+
 	/** Returns the actual struct used for serialization, subclasses must override this! */
 	virtual UScriptStruct* GetScriptStruct() const
 	{
@@ -45,6 +62,18 @@ protected:
 
 	UPROPERTY()
 	bool bIsCriticalHit = false;
+
+	UPROPERTY()
+	bool bHasRandomSeed = false;
+
+	UPROPERTY()
+	int32 RandomSeed = 0;
+
+	// Server side only, executions happen in the same order on every replay
+	uint32 NumExecutions = 0;
+
+	bool bHasResolvedDamage = false;
+	float ResolvedDamage = 0.0f;
 };
 
 template<>